@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------
+//
+//  Module: conio.h
+//
+//  Purpose:
+//     Host stand-in for the DOS console calls the adapter polls. Keys are
+//     read from stdin without waiting, and Ctrl-C comes back as Escape so
+//     the adapter shuts down the same way it does on DOS.
+//
+//  Development Team:
+//     agent
+//
+//  History:   Date       Author      Comment
+//             10/16/26   agent       Wrote it.
+//
+//---------------------------------------------------------------------------
+
+#ifndef _HOST_CONIO_H
+#define _HOST_CONIO_H
+
+#include <signal.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/select.h>
+
+static volatile sig_atomic_t consoleInterrupted = 0 ;
+static int consoleReady = 0 ;
+static struct termios consoleSaved ;
+
+// Puts the terminal back the way we found it
+static inline void consoleRestore( void )
+{
+   tcsetattr( STDIN_FILENO, TCSANOW, &consoleSaved ) ;
+}
+
+// Notes a Ctrl-C, to be picked up as a key
+static inline void consoleInterrupt( int sig )
+{
+   consoleInterrupted = 1 ;
+}
+
+// Turns off line buffering and echo the first time the console is polled
+static inline void consoleSetup( void )
+{
+   struct termios raw ;
+
+   consoleReady = 1 ;
+   signal( SIGINT, consoleInterrupt ) ;
+
+   if ( isatty( STDIN_FILENO ) && tcgetattr( STDIN_FILENO, &consoleSaved ) == 0 )
+   {
+      raw = consoleSaved ;
+      raw.c_lflag &= ~( ICANON | ECHO ) ;
+      tcsetattr( STDIN_FILENO, TCSANOW, &raw ) ;
+      atexit( consoleRestore ) ;
+   }
+}
+
+// Returns 1 if a key is waiting. Only a terminal has keys, anything else on stdin is ignored.
+static inline int kbhit( void )
+{
+   fd_set readSet ;
+   struct timeval timeout = { 0, 0 } ;
+
+   if ( !consoleReady )
+   {
+      consoleSetup( ) ;
+   }
+
+   if ( consoleInterrupted )
+   {
+      return 1 ;
+   }
+
+   if ( !isatty( STDIN_FILENO ) )
+   {
+      return 0 ;
+   }
+
+   FD_ZERO( &readSet ) ;
+   FD_SET( STDIN_FILENO, &readSet ) ;
+   return select( STDIN_FILENO + 1, &readSet, NULL, NULL, &timeout ) > 0 ;
+}
+
+// Returns the waiting key
+static inline int getch( void )
+{
+   unsigned char key ;
+
+   if ( consoleInterrupted )
+   {
+      consoleInterrupted = 0 ;
+      return 0x1b ;
+   }
+
+   if ( read( STDIN_FILENO, &key, 1 ) != 1 )
+   {
+      return 0x1b ;
+   }
+   return key ;
+}
+
+#endif
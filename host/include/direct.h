@@ -0,0 +1,26 @@
+//---------------------------------------------------------------------------
+//
+//  Module: direct.h
+//
+//  Purpose:
+//     Host stand-in for the Watcom directory calls. mkdir takes just the
+//     path, as it does on DOS.
+//
+//  Development Team:
+//     agent
+//
+//  History:   Date       Author      Comment
+//             10/16/26   agent       Wrote it.
+//
+//---------------------------------------------------------------------------
+
+#ifndef _HOST_DIRECT_H
+#define _HOST_DIRECT_H
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+
+#define mkdir( path ) mkdir( ( path ), 0777 )
+
+#endif
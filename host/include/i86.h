@@ -0,0 +1 @@
+// Host stand-in for <i86.h>, nothing the adapter uses from it is needed on the host
@@ -0,0 +1,2 @@
+// Host stand-in for <io.h>, the POSIX calls live in <unistd.h>
+#include <unistd.h>
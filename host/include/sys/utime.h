@@ -0,0 +1,2 @@
+// Host stand-in for the Watcom <sys/utime.h>
+#include <utime.h>
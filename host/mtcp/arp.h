@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP arp.h
+#include "MTCPHOST.H"
@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP dns.h
+#include "MTCPHOST.H"
@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP packet.h
+#include "MTCPHOST.H"
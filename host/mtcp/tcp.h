@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP tcp.h
+#include "MTCPHOST.H"
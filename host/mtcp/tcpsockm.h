@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP tcpsockm.h
+#include "MTCPHOST.H"
@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP timer.h
+#include "MTCPHOST.H"
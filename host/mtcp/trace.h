@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP trace.h
+#include "MTCPHOST.H"
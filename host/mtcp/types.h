@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP types.h
+#include "MTCPHOST.H"
@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP udp.h
+#include "MTCPHOST.H"
@@ -0,0 +1,2 @@
+// Host stand-in for the mTCP utils.h
+#include "MTCPHOST.H"